@@ -5,7 +5,7 @@
 /*	 by Ralf Brown							*/
 /*									*/
 /*  File: wcbatch.h	      batch-of-lines processing			*/
-/*  LastEdit: 21sep2018							*/
+/*  LastEdit: 16oct2026							*/
 /*									*/
 /*  (c) Copyright 2015,2016,2017,2018 Carnegie Mellon University	*/
 /*	This program may be redistributed and/or modified under the	*/
@@ -25,7 +25,12 @@
 #ifndef __WCBATCH_H_INCLUDED
 #define __WCBATCH_H_INCLUDED
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
 #include "framepac/file.h"
+#include "framepac/threadpool.h"
 
 /************************************************************************/
 /*	Manifest Constants						*/
@@ -33,18 +38,139 @@
 
 #define WcLINES_PER_BATCH 10000
 
+// target size of the byte ranges into which memory-mapped files are split
+#define WcBYTES_PER_RANGE (4*1024*1024)
+
 /************************************************************************/
 /*	Types								*/
 /************************************************************************/
 
 typedef bool WcProcessFileFunc(const Fr::LineBatch &lines, const WcParameters *params,
 			       va_list args) ;
+// process the lines in [start,end); the range always ends just after a newline or at EOF
+typedef bool WcProcessRangeFunc(const char *start, const char *end, const WcParameters *params,
+				va_list args) ;
+
+//----------------------------------------------------------------------
+
+// fixed-capacity multi-producer/multi-consumer queue; push() blocks while the queue is full
+//   and pop() blocks while it is empty
+template <typename T>
+class WcBoundedQueue
+   {
+   public:
+      WcBoundedQueue(size_t cap) : m_items(cap), m_head(0), m_count(0) {}
+      ~WcBoundedQueue() = default ;
+
+      size_t capacity() const { return m_items.size() ; }
+
+      void push(T item)
+	 {
+	    std::unique_lock<std::mutex> lock(m_mutex) ;
+	    m_not_full.wait(lock,[this]{ return m_count < m_items.size() ; }) ;
+	    m_items[(m_head + m_count) % m_items.size()] = item ;
+	    ++m_count ;
+	    // notify while still holding the lock, since a waiter in waitUntilFull() may destroy
+	    //   the queue as soon as it can reacquire the lock
+	    m_not_empty.notify_one() ;
+	 }
+      T pop()
+	 {
+	    std::unique_lock<std::mutex> lock(m_mutex) ;
+	    m_not_empty.wait(lock,[this]{ return m_count > 0 ; }) ;
+	    T item = m_items[m_head] ;
+	    m_head = (m_head + 1) % m_items.size() ;
+	    --m_count ;
+	    m_not_full.notify_one() ;
+	    return item ;
+	 }
+      // block until every slot is occupied, i.e. all items handed out have been returned
+      void waitUntilFull()
+	 {
+	    std::unique_lock<std::mutex> lock(m_mutex) ;
+	    m_not_empty.wait(lock,[this]{ return m_count == m_items.size() ; }) ;
+	 }
+
+   protected:
+      std::mutex	      m_mutex ;
+      std::condition_variable m_not_empty ;
+      std::condition_variable m_not_full ;
+      std::vector<T>	      m_items ;
+      size_t		      m_head ;
+      size_t		      m_count ;
+   } ;
+
+//----------------------------------------------------------------------
+
+// tracks the completion of one batch of jobs handed to the thread pool, so that the caller waits
+//   only for its own jobs rather than for the whole pool (which concurrent sweep configurations
+//   share) to go idle
+class WcJobGroup
+   {
+   public:
+      WcJobGroup(Fr::ThreadPool* pool) : m_pool(pool), m_pending(0) {}
+      WcJobGroup(const WcJobGroup&) = delete ;
+      ~WcJobGroup() { wait() ; }
+
+      // run fn(input,output) on the pool, or in the calling thread if the pool won't take it
+      void dispatch(Fr::ThreadPoolWorkFunc* fn, const void* input, void* output) ;
+      // block until every job dispatched so far has completed
+      void wait() ;
+      // called by each job as it completes
+      void finished() ;
+
+   protected:
+      class Job
+	 {
+	 public:
+	    Fr::ThreadPoolWorkFunc* fn ;
+	    const void*	            input ;
+	    void*	            output ;
+	    WcJobGroup*	            group ;
+	 } ;
+      static void runJob(const void* input, void* output) ;
+
+   protected:
+      Fr::ThreadPool*	      m_pool ;
+      std::deque<Job>	      m_jobs ;	// a deque never moves its elements as it grows
+      std::mutex	      m_mutex ;
+      std::condition_variable m_done ;
+      size_t		      m_pending ;
+   } ;
+
+//----------------------------------------------------------------------
+
+// a read-only memory mapping of an entire file
+class WcMappedFile
+   {
+   public:
+      WcMappedFile() : m_data(nullptr), m_size(0) {}
+      WcMappedFile(const WcMappedFile&) = delete ;
+      ~WcMappedFile() { unmap() ; }
+
+      bool map(const char* filename) ;
+      void unmap() ;
+
+      const char* data() const { return m_data ; }
+      size_t size() const { return m_size ; }
+
+   protected:
+      const char* m_data ;
+      size_t      m_size ;
+   } ;
 
 /************************************************************************/
 /************************************************************************/
 
 bool WcProcessFile(Fr::CFile& fp, const WcParameters *params, WcProcessFileFunc *fn, ...) ;
 
+bool WcCanMapFile(const char *filename) ;
+// process the files in 'filenames' by memory-mapping them; any which can't be mapped after all are
+//   added to 'unmapped' (if non-null) for the caller to read another way, and otherwise count as
+//   a failure
+bool WcProcessMappedFiles(const std::vector<const char*>& filenames, const WcParameters *params,
+			  std::vector<const char*>* unmapped, WcProcessRangeFunc *fn, ...) ;
+
 #endif /* !__WCBATCH_H_INCLUDED */
 
 // end of file wcbatch.h //
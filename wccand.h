@@ -0,0 +1,161 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*  WordClust -- Word Clustering					*/
+/*  Version 2.00							*/
+/*	 by Ralf Brown							*/
+/*									*/
+/*  File: wccand.h	      candidate pairs for clustering (LSH)		*/
+/*  LastEdit: 17oct2026							*/
+/*									*/
+/*  (c) Copyright 2018 Carnegie Mellon University			*/
+/*	This program may be redistributed and/or modified under the	*/
+/*	terms of the GNU General Public License, version 3, or an	*/
+/*	alternative license agreement as detailed in the accompanying	*/
+/*	file LICENSE.  You should also have received a copy of the	*/
+/*	GPL (file COPYING) along with this program.  If not, see	*/
+/*	http://www.gnu.org/licenses/					*/
+/*									*/
+/*	This program is distributed in the hope that it will be		*/
+/*	useful, but WITHOUT ANY WARRANTY; without even the implied	*/
+/*	warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR		*/
+/*	PURPOSE.  See the GNU General Public License for more details.	*/
+/*									*/
+/************************************************************************/
+
+#ifndef __WCCAND_H_INCLUDED
+#define __WCCAND_H_INCLUDED
+
+#include <cfloat>
+#include <vector>
+#include "framepac/vecsim.h"
+#include "wordclus.h"
+
+/************************************************************************/
+/*	Manifest Constants						*/
+/************************************************************************/
+
+// maximum number of vectors sampled when estimating the recall of the candidate index
+#define WcCANDIDATE_RECALL_SAMPLE 1000
+
+/************************************************************************/
+/*	Types								*/
+/************************************************************************/
+
+// union-find forest over the nodes 0..n-1, used to group the vectors connected by candidate pairs
+
+class WcDisjointSets
+   {
+   public:
+      WcDisjointSets(size_t n) : m_parent(n)
+	 {
+	    for (size_t i = 0 ; i < n ; ++i)
+	       m_parent[i] = (uint32_t)i ;
+	 }
+      ~WcDisjointSets() {}
+
+      size_t size() const { return m_parent.size() ; }
+      uint32_t find(uint32_t node)
+	 {
+	    while (m_parent[node] != node)
+	       {
+	       m_parent[node] = m_parent[m_parent[node]] ;	// path halving
+	       node = m_parent[node] ;
+	       }
+	    return node ;
+	 }
+      void merge(uint32_t node1, uint32_t node2)
+	 {
+	    node1 = find(node1) ;
+	    node2 = find(node2) ;
+	    if (node1 < node2)
+	       m_parent[node2] = node1 ;
+	    else if (node2 < node1)
+	       m_parent[node1] = node2 ;
+	 }
+
+   protected:
+      std::vector<uint32_t> m_parent ;
+   } ;
+
+//----------------------------------------------------------------------------
+
+// MinHash locality-sensitive hashing over the positional context IDs of the term vectors.  Each
+//   vector gets 'bands' band keys, each combining 'rows' min-hashes of its (optionally
+//   top-weighted) context IDs; two vectors are candidates for clustering together iff they share
+//   at least one band key.  More bands raise recall, more rows per band raise precision.
+
+class WcCandidateIndex
+   {
+   public:
+      WcCandidateIndex(unsigned bands, unsigned rows, size_t top_terms) ;
+      WcCandidateIndex(const WcCandidateIndex&) = delete ;
+      ~WcCandidateIndex() { release() ; }
+      WcCandidateIndex& operator= (const WcCandidateIndex&) = delete ;
+
+      // compute band keys for all sparse term vectors in 'vectors'; returns the number indexed
+      size_t build(const Fr::Array* vectors) ;
+      // detach the indexed vectors and discard the band keys
+      void release() ;
+
+      size_t size() const { return m_owners.size() ; }
+      bool candidates(uint32_t row1, uint32_t row2) const
+	 {
+	    const uint32_t* keys1 = m_keys.data() + (size_t)row1 * m_bands ;
+	    const uint32_t* keys2 = m_keys.data() + (size_t)row2 * m_bands ;
+	    for (unsigned b = 0 ; b < m_bands ; ++b)
+	       {
+	       if (keys1[b] == keys2[b])
+		  return true ;
+	       }
+	    return false ;
+	 }
+      // merge the sets of any two rows which are candidates for each other; 'sets' must have at
+      //   least size() nodes, the first size() of which stand for the rows of the index
+      void connect(WcDisjointSets& sets) const ;
+
+      // compare all pairs among a sample of the indexed vectors, both exhaustively and restricted
+      //   to candidate pairs, and report the recall and time of the latter relative to the former
+      void reportRecall(const Fr::Array* vectors, const Fr::VectorMeasure<WcWordCorpus::ID,float>* measure,
+			double threshold) const ;
+
+      // compute the band keys for a single vector into keys[0..bands-1]
+      void signature(const WcTermVector* tv, uint32_t* keys) const ;
+
+   protected:
+      std::vector<class WcTermVectorInfo*> m_owners ;
+      std::vector<uint32_t> m_keys ;		// m_bands keys for each row
+      std::vector<uint64_t> m_seeds ;		// m_bands * m_rows hash seeds
+      size_t   m_top_terms ;
+      unsigned m_bands ;
+      unsigned m_rows ;
+   } ;
+
+//----------------------------------------------------------------------------
+
+// skips the wrapped similarity computation for any pair of indexed vectors which the candidate
+//   index says are not worth comparing
+template <typename IdxT, typename ValT>
+class VectorMeasureCandidates : public Fr::WrappedVectorMeasure<IdxT,ValT>
+   {
+   public:
+      typedef Fr::WrappedVectorMeasure<IdxT,ValT> super ;
+   public:
+      VectorMeasureCandidates(Fr::VectorMeasure<IdxT,ValT>* base) : super(base) {}
+      ~VectorMeasureCandidates() {}
+
+      virtual double similarity(const Fr::Vector<IdxT,ValT>* v1, const Fr::Vector<IdxT,ValT>* v2) const
+	 {
+	    return pruned(v1,v2) ? 0.0 : this->baseSimilarity(v1,v2) ;
+	 }
+      virtual double distance(const Fr::Vector<IdxT,ValT>* v1, const Fr::Vector<IdxT,ValT>* v2) const
+	 {
+	    return pruned(v1,v2) ? DBL_MAX : this->baseDistance(v1,v2) ;
+	 }
+
+   protected:
+      static bool pruned(const Fr::Vector<IdxT,ValT>* v1, const Fr::Vector<IdxT,ValT>* v2) ;
+   } ;
+
+#endif /* !__WCCAND_H_INCLUDED */
+
+// end of file wccand.h //
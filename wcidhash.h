@@ -0,0 +1,119 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*  WordClust -- Word Clustering					*/
+/*  Version 2.00							*/
+/*	 by Ralf Brown							*/
+/*									*/
+/*  File: wcidhash.h	      counts of positional context IDs		*/
+/*  LastEdit: 16oct2026							*/
+/*									*/
+/*  (c) Copyright 2017,2018 Carnegie Mellon University			*/
+/*	This program may be redistributed and/or modified under the	*/
+/*	terms of the GNU General Public License, version 3, or an	*/
+/*	alternative license agreement as detailed in the accompanying	*/
+/*	file LICENSE.  You should also have received a copy of the	*/
+/*	GPL (file COPYING) along with this program.  If not, see	*/
+/*	http://www.gnu.org/licenses/					*/
+/*									*/
+/*	This program is distributed in the hope that it will be		*/
+/*	useful, but WITHOUT ANY WARRANTY; without even the implied	*/
+/*	warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR		*/
+/*	PURPOSE.  See the GNU General Public License for more details.	*/
+/*									*/
+/************************************************************************/
+
+#ifndef __WCIDHASH_H_INCLUDED
+#define __WCIDHASH_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+/************************************************************************/
+/*	Manifest Constants						*/
+/************************************************************************/
+
+// bounds on the number of slots allocated up front; the table grows as needed beyond the maximum
+#define WcIDCOUNT_MIN_SLOTS 16
+#define WcIDCOUNT_MAX_INITIAL_SLOTS 16384
+
+/************************************************************************/
+/*	Types								*/
+/************************************************************************/
+
+// counter for the positional context IDs of a single term: 32-bit keys, saturating 32-bit
+//   counts, and linear probing in parallel key/count arrays.  Key ~0U is reserved to mark
+//   empty slots and is never stored.
+
+class WcIDCountHashTable
+   {
+   public:
+      typedef uint32_t key_type ;
+      typedef uint32_t count_type ;
+      typedef std::pair<key_type,count_type> entry_type ;
+      static constexpr key_type EMPTY = ~0U ;
+
+      class const_iterator
+	 {
+	 public:
+	    const_iterator(const WcIDCountHashTable* ht, size_t pos) : m_table(ht), m_pos(pos) { skipEmpty() ; }
+	    entry_type operator* () const
+	       { return entry_type(m_table->m_keys[m_pos],m_table->m_counts[m_pos]) ; }
+	    const_iterator& operator++ () { ++m_pos ; skipEmpty() ; return *this ; }
+	    bool operator!= (const const_iterator& other) const { return m_pos != other.m_pos ; }
+	 protected:
+	    void skipEmpty()
+	       { while (m_pos < m_table->m_capacity && m_table->m_keys[m_pos] == EMPTY) ++m_pos ; }
+	 protected:
+	    const WcIDCountHashTable* m_table ;
+	    size_t m_pos ;
+	 } ;
+   public:
+      // 'expected' is an estimate of the number of distinct keys, e.g. the number of context
+      //   positions times the term's frequency
+      WcIDCountHashTable(size_t expected = 0) ;
+      WcIDCountHashTable(const WcIDCountHashTable&) = delete ;
+      ~WcIDCountHashTable() ;
+      WcIDCountHashTable& operator= (const WcIDCountHashTable&) = delete ;
+
+      size_t currentSize() const { return m_size ; }
+      size_t capacity() const { return m_capacity ; }
+      count_type addCount(key_type key, size_t incr) ;
+      count_type lookup(key_type key) const ;
+      void merge(const WcIDCountHashTable& other) ;
+      void clear() ;
+
+      // extract all entries into the caller's arrays (each of at least currentSize() elements)
+      //   in order of increasing key, leaving the table empty; returns the number of entries
+      template <typename KeyT, typename ValT>
+      size_t drainSorted(KeyT* keys, ValT* values)
+	 {
+	    size_t count = sortEntries() ;
+	    for (size_t i = 0 ; i < count ; ++i)
+	       {
+	       keys[i] = m_keys[i] ;
+	       values[i] = m_counts[i] ;
+	       }
+	    clear() ;
+	    return count ;
+	 }
+
+      const_iterator begin() const { return const_iterator(this,0) ; }
+      const_iterator end() const { return const_iterator(this,m_capacity) ; }
+
+   protected:
+      void allocate(size_t slots) ;
+      void grow() ;
+      size_t sortEntries() ;
+
+   protected:
+      key_type*   m_keys ;
+      count_type* m_counts ;
+      size_t      m_capacity ;		// always a power of two
+      unsigned    m_bits ;		// log2(m_capacity)
+      size_t      m_size ;
+   } ;
+
+#endif /* !__WCIDHASH_H_INCLUDED */
+
+// end of file wcidhash.h //
@@ -0,0 +1,116 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*  WordClust -- Word Clustering					*/
+/*  Version 2.00							*/
+/*	 by Ralf Brown							*/
+/*									*/
+/*  File: wcmetrics.h	      per-pass performance metrics		*/
+/*  LastEdit: 17oct2026							*/
+/*									*/
+/*  (c) Copyright 2018 Carnegie Mellon University			*/
+/*	This program may be redistributed and/or modified under the	*/
+/*	terms of the GNU General Public License, version 3, or an	*/
+/*	alternative license agreement as detailed in the accompanying	*/
+/*	file LICENSE.  You should also have received a copy of the	*/
+/*	GPL (file COPYING) along with this program.  If not, see	*/
+/*	http://www.gnu.org/licenses/					*/
+/*									*/
+/*	This program is distributed in the hope that it will be		*/
+/*	useful, but WITHOUT ANY WARRANTY; without even the implied	*/
+/*	warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR		*/
+/*	PURPOSE.  See the GNU General Public License for more details.	*/
+/*									*/
+/************************************************************************/
+
+#ifndef __WCMETRICS_H_INCLUDED
+#define __WCMETRICS_H_INCLUDED
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+
+/************************************************************************/
+/*	Types								*/
+/************************************************************************/
+
+// CPU time consumed by each of the process's threads, keyed by thread ID
+typedef std::map<long,double> WcThreadTimes ;
+
+// a snapshot of the process's resource usage
+class WcUsage
+   {
+   public:
+      std::chrono::steady_clock::time_point wall ;
+      double        cpu_secs { 0.0 } ;		// user + system time, all threads
+      size_t        peak_rss_kb { 0 } ;		// resident-set high-water mark since last reset
+      uint64_t      allocations { 0 } ;
+      WcThreadTimes threads ;
+   public:
+      static void sample(WcUsage& usage, bool per_thread) ;
+   } ;
+
+//----------------------------------------------------------------------
+
+// the measurements for one pass of the pipeline
+class WcPassRecord
+   {
+   public:
+      std::string   name ;
+      double        wall_secs { 0.0 } ;
+      double        cpu_secs { 0.0 } ;
+      size_t        peak_rss_kb { 0 } ;
+      uint64_t      allocations { 0 } ;
+      size_t        items { 0 } ;
+      bool          pass_peak_rss { false } ;	// peak_rss_kb is for the pass, not the whole process
+      WcThreadTimes busy ;		// CPU seconds used by each thread during the pass
+   } ;
+
+//----------------------------------------------------------------------
+
+// measures the enclosing scope as one pass, if metrics collection has been enabled; passes may
+//   nest (e.g. MI computation inside a larger analysis pass), and each is recorded separately
+class WcPassMetrics
+   {
+   public:
+      WcPassMetrics(const char* name) ;
+      WcPassMetrics(const WcPassMetrics&) = delete ;
+      ~WcPassMetrics() { finish() ; }
+      WcPassMetrics& operator= (const WcPassMetrics&) = delete ;
+
+      // record the number of items (tokens, bigrams, vectors, ...) processed by the pass
+      void items(size_t count) { m_items = count ; }
+      void addItems(size_t count) { m_items += count ; }
+      // record the pass now instead of at the end of the scope
+      void finish() ;
+
+   protected:
+      const char* m_name ;
+      WcUsage     m_start ;
+      size_t      m_items { 0 } ;
+      size_t      m_first_reset { 0 } ;	// first high-water-mark reset made during the pass
+      bool        m_active ;
+      bool        m_rss_reset { false } ;
+   } ;
+
+/************************************************************************/
+/************************************************************************/
+
+void WcEnableMetrics(bool enable) ;
+bool WcMetricsEnabled() ;
+
+// the library never replaces the global allocator; an executable that counts its allocations
+//   registers a function returning the count so far, which is then recorded for each pass
+typedef uint64_t WcAllocCountFunc() ;
+void WcSetAllocationCounter(WcAllocCountFunc* fn) ;
+
+// number of C++ heap allocations made so far by all threads (zero if no counter is registered)
+uint64_t WcAllocationCount() ;
+
+// write all recorded passes to 'filename' as CSV (if the name ends in ".csv") or JSON
+bool WcWriteMetrics(const char* filename) ;
+
+#endif /* !__WCMETRICS_H_INCLUDED */
+
+// end of file wcmetrics.h //
@@ -0,0 +1,97 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*  WordClust -- Word Clustering					*/
+/*  Version 2.00							*/
+/*	 by Ralf Brown							*/
+/*									*/
+/*  File: wcmiscore.h	      batched mutual-information scoring		*/
+/*  LastEdit: 17oct2026							*/
+/*									*/
+/*  (c) Copyright 2018 Carnegie Mellon University			*/
+/*	This program may be redistributed and/or modified under the	*/
+/*	terms of the GNU General Public License, version 3, or an	*/
+/*	alternative license agreement as detailed in the accompanying	*/
+/*	file LICENSE.  You should also have received a copy of the	*/
+/*	GPL (file COPYING) along with this program.  If not, see	*/
+/*	http://www.gnu.org/licenses/					*/
+/*									*/
+/*	This program is distributed in the hope that it will be		*/
+/*	useful, but WITHOUT ANY WARRANTY; without even the implied	*/
+/*	warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR		*/
+/*	PURPOSE.  See the GNU General Public License for more details.	*/
+/*									*/
+/************************************************************************/
+
+#ifndef __WCMISCORE_H_INCLUDED
+#define __WCMISCORE_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+/************************************************************************/
+/*	Manifest Constants						*/
+/************************************************************************/
+
+// number of bigrams collected before a block is scored
+#define WcMI_BLOCK_SIZE 4096
+
+/************************************************************************/
+/*	Types								*/
+/************************************************************************/
+
+// compute scores[i] for the bigrams whose first word occurs freq1[i] times, whose second word
+//   occurs freq2[i] times, and which co-occur cooccur[i] times in a corpus of 'total' tokens.
+//   The kernels are plain loops over the arrays, which the compiler vectorizes.
+typedef void WcMIBatchScoreFunc(const double* freq1, const double* freq2, const double* cooccur,
+				size_t n, double total, double* scores) ;
+
+class WcMIScorer
+   {
+   public:
+      const char*	  name ;
+      const char*	  description ;
+      WcMIBatchScoreFunc* score ;
+   } ;
+
+// the bigrams collected by one enumeration thread, in structure-of-arrays form
+class WcMIBlock
+   {
+   public:
+      uint32_t word1[WcMI_BLOCK_SIZE] ;
+      uint32_t word2[WcMI_BLOCK_SIZE] ;
+      double   freq1[WcMI_BLOCK_SIZE] ;
+      double   freq2[WcMI_BLOCK_SIZE] ;
+      double   cooccur[WcMI_BLOCK_SIZE] ;
+      double   scores[WcMI_BLOCK_SIZE] ;
+      size_t   count { 0 } ;
+   public:
+      bool full() const { return count >= WcMI_BLOCK_SIZE ; }
+      void add(uint32_t w1, uint32_t w2, double f1, double f2, double cooc)
+	 {
+	    word1[count] = w1 ; word2[count] = w2 ;
+	    freq1[count] = f1 ; freq2[count] = f2 ; cooccur[count] = cooc ;
+	    ++count ;
+	 }
+   } ;
+
+/************************************************************************/
+/************************************************************************/
+
+// look up a scorer by (case-insensitive) name; returns nullptr if there is no such scorer
+const WcMIScorer* WcFindMIScorer(const char* name) ;
+
+// add a scorer to the registry (replacing any existing scorer of the same name); the strings
+//   must remain valid for the life of the program
+bool WcRegisterMIScorer(const char* name, const char* description, WcMIBatchScoreFunc* fn) ;
+
+void WcListMIScorers(std::ostream& out) ;
+
+// compute the scores of all bigrams in the block with 'scorer' (if null, the caller has already
+//   filled in block.scores), then compact the block's word1/word2 arrays to just those bigrams
+//   scoring at least 'threshold' which do not co-occur by chance; returns the number kept
+size_t WcFilterMIBlock(WcMIBlock& block, const WcMIScorer* scorer, double total, double threshold) ;
+
+#endif /* !__WCMISCORE_H_INCLUDED */
+
+// end of file wcmiscore.h //
@@ -5,7 +5,7 @@
 /*	 by Ralf Brown							*/
 /*									*/
 /*  File: wcparam.h	      WcParameters structure			*/
-/*  LastEdit: 21sep2018							*/
+/*  LastEdit: 16oct2026							*/
 /*									*/
 /*  (c) Copyright 1999,2000,2001,2002,2003,2005,2006,2008,2009,2010,	*/
 /*		2015,2016,2017,2018 Carnegie Mellon University		*/
@@ -40,6 +40,8 @@ class WcParameters
       class WcWordIDPairTable* m_mutualinfo_id { nullptr } ;
       WcWordCorpus*      m_corpus { nullptr } ;
       Fr::ContextVectorCollection<WcWordCorpus::ID,uint32_t,float,false>* m_contextcoll { nullptr } ;
+      const class WcWeightTables* m_weight_tables { nullptr } ;
+      class WcContextCounts* m_context_counts { nullptr } ;
       size_t             m_min_wordfreq { 0 } ;
       size_t             m_max_wordfreq { UINT_MAX } ;
       size_t             m_rare_threshold { 0 } ;
@@ -56,6 +58,12 @@ class WcParameters
       int                m_mono_skip { 0 } ;
       unsigned           m_max_equiv_length { 100 } ;
       unsigned           m_max_context_length { 1 } ;
+      unsigned           m_lsh_bands { 0 } ;	// 0 = compare all pairs when clustering
+      unsigned           m_lsh_rows { 4 } ;
+      size_t             m_lsh_terms { 0 } ;	// 0 = min-hash all of a vector's contexts
+      size_t             m_tagged_chunk { 0 } ;	// 0 = build the tagged corpus in memory
+      size_t             m_partition_budget { 0 } ;	// bytes; 0 = analyze the whole vocabulary at once
+      size_t             m_corpus_cache_limit { 0 } ;	// bytes; 0 = never trim the corpus cache
       size_t             m_phrase_length { 1 } ;
       double             m_threshold { 0.3 } ;
       double             MI_threshold { 0.0 } ;
@@ -78,9 +86,15 @@ class WcParameters
       const char* m_cluster_measure { nullptr } ;
       const char* m_cluster_rep { nullptr } ;
       const char* m_cluster_settings { nullptr } ;
+      const char* m_mi_scorer { nullptr } ;	// name of registered MI scorer; null = default
       const char* m_stopwords_file { nullptr } ;
       const char* m_equiv_class_file { nullptr } ;
       const char* m_context_equivs_file { nullptr } ;
+      const char* m_corpus_cache_dir { nullptr } ;
+      const char* m_save_vectors_file { nullptr } ;	// checkpoint written after context analysis
+      const char* m_save_counts_file { nullptr } ;	// raw context counts for later updates
+      const char* m_warm_start_file { nullptr } ;	// cluster assignments from an earlier run
+      const char* m_save_assignments_file { nullptr } ;
       bool        m_verbose { false } ;
       bool        m_showmem { false } ;
       bool        m_use_chi_squared { false } ;
@@ -102,6 +116,7 @@ class WcParameters
       double      m_decay_beta { 0.5 } ;
       double      m_decay_gamma { 0.1 } ;
       double      m_termfreq_discount { 1.0 } ;
+      double      m_drift_threshold { 0.1 } ;	// max centroid movement for a warm start
       size_t      left_context { 0 } ;	// extra words used to disambiguate senses when clustering
       size_t      right_context { 0 } ;
       WcDecayType m_decay_type { Decay_Reciprocal } ;
@@ -153,6 +168,9 @@ class WcParameters
       int monoSkip() const { return m_mono_skip ; }
       unsigned maxEquivLength() const { return m_max_equiv_length ; }
       unsigned maxContextEquivLength() const { return m_max_context_length ; }
+      unsigned lshBands() const { return m_lsh_bands ; }
+      unsigned lshRows() const { return m_lsh_rows ; }
+      size_t lshTerms() const { return m_lsh_terms ; }
       bool runVerbosely() const { return m_verbose ; }
       bool showMemory() const { return m_showmem ; }
       bool skipAutoClusters() const { return m_skip_auto_clusters ; }
@@ -172,11 +190,15 @@ class WcParameters
       bool excludePunctuation() const { return  m_exclude_punct ; }
       bool punctuationAsStopwords() const { return m_punct_as_stopwords ; }
       bool keepSingletons() const { return m_keep_singletons ; }
+      size_t taggedChunkSize() const { return m_tagged_chunk ; }
+      size_t partitionBudget() const { return m_partition_budget ; }
+      size_t corpusCacheLimit() const { return m_corpus_cache_limit ; }
       bool noPeriodMutualInfo() const { return m_no_period_MI ; }
       bool keepNumbersDistinct() const { return m_distinct_numbers ; }
       bool keepPunctuationDistinct() const { return m_distinct_punct ; }
       WcMIScoreFuncID *miScoreFuncID() const { return m_mi_score_func_id ; }
       void *miScoreData() const { return m_mi_score_data ; }
+      const char* miScorer() const { return m_mi_scorer ; }
       WcWordFreqProcFunc *wordFreqFunc() const { return m_wordfreq_func ; }
       WcVectorFilterFunc *preFilterFunc() const { return m_prefilter_func ; }
       void *preFilterData() const { return m_prefilter_data ; }
@@ -191,6 +213,12 @@ class WcParameters
       Fr::SymHashTable *equivalenceClasses() const { return m_equiv_classes ; }
       const char* equivClassFile() const { return m_equiv_class_file ; }
       const char* contextEquivClassFile() const { return m_context_equivs_file ; }
+      const char* corpusCacheDir() const { return m_corpus_cache_dir ; }
+      const char* saveVectorsFile() const { return m_save_vectors_file ; }
+      const char* saveCountsFile() const { return m_save_counts_file ; }
+      const char* warmStartFile() const { return m_warm_start_file ; }
+      const char* saveAssignmentsFile() const { return m_save_assignments_file ; }
+      double driftThreshold() const { return m_drift_threshold ; }
       const char* clusteringMethod() const { return m_cluster_method ; }
       const char* clusteringMeasure() const { return  m_cluster_measure ; }
       const char* clusteringRep() const { return m_cluster_rep ; }
@@ -200,6 +228,8 @@ class WcParameters
       WcWordCorpus *corpus() const { return m_corpus ; }
       Fr::ContextVectorCollection<WcWordCorpus::ID,uint32_t,float,false>* contextCollection() const
 	 { return m_contextcoll ; }
+      const class WcWeightTables* weightTables() const { return m_weight_tables ; }
+      class WcContextCounts* contextCounts() const { return m_context_counts ; }
 
       // modifiers
       void desiredClusters(size_t cl) { m_desired_clusters = cl ; }
@@ -208,6 +238,9 @@ class WcParameters
       void neighborhoodLeft(size_t n) { m_src_context_left = n ; }
       void neighborhoodRight(size_t n) { m_src_context_right = n ; }
       void dimensions(size_t dim) { m_dimensions = dim ; }
+      void lshBands(unsigned bands) { m_lsh_bands = bands ; }
+      void lshRows(unsigned rows) { m_lsh_rows = rows ; }
+      void lshTerms(size_t terms) { m_lsh_terms = terms ; }
       void basis(size_t plus, size_t minus) { m_basis_plus = plus ; m_basis_minus = minus ; }
       void minWordFreq(size_t freq) { if (freq > m_min_wordfreq) m_min_wordfreq = freq ; }
       void maxWordFreq(size_t freq) { m_max_wordfreq = freq ; }
@@ -237,6 +270,9 @@ class WcParameters
       void excludePunctuation(bool xp) { m_exclude_punct = xp ; }
       void punctuationAsStopwords(bool p) { m_punct_as_stopwords = p ; }
       void keepSingletons(bool keep) { m_keep_singletons = keep ; }
+      void taggedChunkSize(size_t entries) { m_tagged_chunk = entries ; }
+      void partitionBudget(size_t bytes) { m_partition_budget = bytes ; }
+      void corpusCacheLimit(size_t bytes) { m_corpus_cache_limit = bytes ; }
       void noPeriodMutualInfo(bool pmi) { m_no_period_MI = pmi ; }
       void keepNumbersDistinct(bool dist) { m_distinct_numbers = dist ; }
       void keepPunctuationDistinct(bool dist) { m_distinct_punct = dist ; }
@@ -245,6 +281,12 @@ class WcParameters
       void equivalenceClasses(Fr::SymHashTable *eq) { m_equiv_classes = eq ; }
       void equivClassFile(const char *eq) { m_equiv_class_file = eq ; }
       void contextEquivClassFile(const char *eq) { m_context_equivs_file = eq ; }
+      void corpusCacheDir(const char *dir) { m_corpus_cache_dir = dir ; }
+      void saveVectorsFile(const char *file) { m_save_vectors_file = file ; }
+      void saveCountsFile(const char *file) { m_save_counts_file = file ; }
+      void warmStartFile(const char *file) { m_warm_start_file = file ; }
+      void saveAssignmentsFile(const char *file) { m_save_assignments_file = file ; }
+      void driftThreshold(double drift) { m_drift_threshold = drift ; }
       void clusteringMethod(const char* cm) { m_cluster_method = cm ; }
       void clusteringMeasure(const char* cm) { m_cluster_measure = cm ; }
       void clusteringRep(const char* cr) { m_cluster_rep = cr ; }
@@ -253,6 +295,7 @@ class WcParameters
       void mutualInfoID(class WcWordIDPairTable *mi) { m_mutualinfo_id = mi ; }
       void corpus(WcWordCorpus *c) { m_corpus = c ; }
       void miScoreFuncID(WcMIScoreFuncID *fn, void *udata) { m_mi_score_func_id = fn ; m_mi_score_data = udata ; }
+      void miScorer(const char* name) { m_mi_scorer = name ; }
       void wordFreqFunc(WcWordFreqProcFunc *fn, void * /*udata*/ = nullptr)
 	 { m_wordfreq_func = fn ; }
       void preFilterFunc(WcVectorFilterFunc *fn, void *udata)
@@ -267,6 +310,8 @@ class WcParameters
 	 { m_clusterpostproc_func = fn ; m_clusterpostproc_data = udata ; }	 
       void contextCollection(Fr::ContextVectorCollection<WcWordCorpus::ID,uint32_t,float,false>* c)
 	 { m_contextcoll = c ; }
+      void weightTables(const class WcWeightTables* tables) { m_weight_tables = tables ; }
+      void contextCounts(class WcContextCounts* counts) { m_context_counts = counts ; }
    } ;
 
 /************************************************************************/
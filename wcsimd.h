@@ -0,0 +1,64 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*  WordClust -- Word Clustering					*/
+/*  Version 2.00							*/
+/*	 by Ralf Brown							*/
+/*									*/
+/*  File: wcsimd.h	      vectorized similarity kernels		*/
+/*  LastEdit: 17oct2026							*/
+/*									*/
+/*  (c) Copyright 2018 Carnegie Mellon University			*/
+/*	This program may be redistributed and/or modified under the	*/
+/*	terms of the GNU General Public License, version 3, or an	*/
+/*	alternative license agreement as detailed in the accompanying	*/
+/*	file LICENSE.  You should also have received a copy of the	*/
+/*	GPL (file COPYING) along with this program.  If not, see	*/
+/*	http://www.gnu.org/licenses/					*/
+/*									*/
+/*	This program is distributed in the hope that it will be		*/
+/*	useful, but WITHOUT ANY WARRANTY; without even the implied	*/
+/*	warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR		*/
+/*	PURPOSE.  See the GNU General Public License for more details.	*/
+/*									*/
+/************************************************************************/
+
+#ifndef __WCSIMD_H_INCLUDED
+#define __WCSIMD_H_INCLUDED
+
+#include <cstddef>
+#include <cstdint>
+
+/************************************************************************/
+/*	Types								*/
+/************************************************************************/
+
+// find the elements common to the strictly-increasing arrays a[0..na-1] and b[0..nb-1], storing
+//   the positions of the matches in match_a and match_b (each must have room for min(na,nb)
+//   elements); returns the number of matches
+typedef size_t WcIntersectFunc(const uint32_t* a, size_t na, const uint32_t* b, size_t nb,
+			       uint32_t* match_a, uint32_t* match_b) ;
+
+// a reduction over two dense float arrays of n elements (dot product or squared distance)
+typedef double WcDenseFunc(const float* a, const float* b, size_t n) ;
+
+/************************************************************************/
+/************************************************************************/
+
+// uses the best kernel supported by the CPU we are running on
+size_t WcIntersectSorted(const uint32_t* a, size_t na, const uint32_t* b, size_t nb,
+			 uint32_t* match_a, uint32_t* match_b) ;
+
+// name of the kernel selected by WcIntersectSorted ("scalar", "avx2", or "avx512")
+const char* WcIntersectKernel() ;
+
+// dense-vector kernels, again using the best the CPU supports; they are fastest when both
+//   arrays are 64-byte aligned and n is a multiple of 16
+double WcDotProduct(const float* a, const float* b, size_t n) ;
+double WcSquaredDistance(const float* a, const float* b, size_t n) ;
+
+// name of the kernels selected for the dense-vector functions ("scalar", "avx2+fma", or "avx512")
+const char* WcDenseKernel() ;
+
+#endif /* !__WCSIMD_H_INCLUDED */
+
+// end of file wcsimd.h //
@@ -0,0 +1,70 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*  WordClust -- Word Clustering					*/
+/*  Version 2.00							*/
+/*	 by Ralf Brown							*/
+/*									*/
+/*  File: wcsweep.h	      parameter sweeps over one vector set	*/
+/*  LastEdit: 17oct2026							*/
+/*									*/
+/*  (c) Copyright 2018 Carnegie Mellon University			*/
+/*	This program may be redistributed and/or modified under the	*/
+/*	terms of the GNU General Public License, version 3, or an	*/
+/*	alternative license agreement as detailed in the accompanying	*/
+/*	file LICENSE.  You should also have received a copy of the	*/
+/*	GPL (file COPYING) along with this program.  If not, see	*/
+/*	http://www.gnu.org/licenses/					*/
+/*									*/
+/*	This program is distributed in the hope that it will be		*/
+/*	useful, but WITHOUT ANY WARRANTY; without even the implied	*/
+/*	warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR		*/
+/*	PURPOSE.  See the GNU General Public License for more details.	*/
+/*									*/
+/************************************************************************/
+
+
+#ifndef __WCSWEEP_H_INCLUDED
+#define __WCSWEEP_H_INCLUDED
+
+#include <string>
+#include <vector>
+#include "wordclus.h"
+
+/************************************************************************/
+/*	Types								*/
+/************************************************************************/
+
+// one clustering configuration of a sweep; empty strings and negative numbers leave the
+//   corresponding setting of the base parameters unchanged
+class WcSweepConfig
+   {
+   public:
+      std::string name ;
+      std::string method ;		// as for -ct
+      std::string measure ;		// as for -cm
+      std::string rep ;			// as for -cr
+      double      threshold { -1.0 } ;	// as for -t
+      long        clusters { -1 } ;	// as for -#
+   } ;
+
+/************************************************************************/
+/************************************************************************/
+
+// read configurations from 'filename', one per line:
+//	NAME METHOD MEASURE REP THRESHOLD CLUSTERS
+//   where '-' keeps the base setting; blank lines and lines starting with '#' are skipped
+bool WcLoadSweepConfigs(const char* filename, std::vector<WcSweepConfig>& configs) ;
+
+// cluster the term vectors saved in 'vector_file' once under each of the configurations,
+//   running up to 'jobs' configurations at a time.  The vectors are loaded just once; since
+//   clustering labels them, the configurations cluster them one at a time, each overlapping the
+//   writing of its results with the next one's clustering.  Each configuration writes its clusters
+//   (and token file and tagged corpus, if requested) to the given names with ".NAME" appended,
+//   and a summary of the configurations and their timings is written to OUTFILE.sweep.csv.
+bool WcRunSweep(const char* vector_file, const std::vector<WcSweepConfig>& configs,
+		const WcParameters* global_params, unsigned jobs, const char* outfilename,
+		const char* tokfilename, const char* tagfilename) ;
+
+#endif /* !__WCSWEEP_H_INCLUDED */
+
+// end of file wcsweep.h //
@@ -5,7 +5,7 @@
 /*	 by Ralf Brown							*/
 /*									*/
 /*  File: wctrmvec.h	      term vector declarations			*/
-/*  LastEdit: 21sep2018							*/
+/*  LastEdit: 16oct2026							*/
 /*									*/
 /*  (c) Copyright 1999,2000,2001,2002,2003,2005,2006,2008,2009,2010,	*/
 /*		2015,2016,2017,2018 Carnegie Mellon University		*/
@@ -30,6 +30,8 @@
 #include "framepac/vecsim.h"
 #include "wcparam.h"
 
+class WcCandidateIndex ;
+
 //----------------------------------------------------------------------
 
 class WcTermVectorInfo
@@ -43,16 +45,45 @@ class WcTermVectorInfo
       const Fr::List* leftConstraint() const { return m_left_constraint; }
       const Fr::List* rightConstraint() const { return m_right_constraint; }
 
+      // squared lengths of the left- and right-context portions of the vector, valid only
+      //   if they were computed for 'vec' (vectors cloned from ours may share the info)
+      bool splitNorms(const void* vec, double& left, double& right) const
+	 {
+	    if (vec != m_normed_vector) return false ;
+	    left = m_left_norm ; right = m_right_norm ;
+	    return true ;
+	 }
+
       // manipulators
       void setCorpus(const WcWordCorpus* corp) { m_corpus = corp ; }
       void leftConstraint(const Fr::List* c) ;
       void rightConstraint(const Fr::List* c) ;
+      void setSplitNorms(const void* vec, double left, double right)
+	 { m_normed_vector = vec ; m_left_norm = left ; m_right_norm = right ; }
+      void clearSplitNorms() { m_normed_vector = nullptr ; }
+
+      // the row holding the band keys for 'vec', if it has been added to a candidate index
+      bool candidateRow(const void* vec, const WcCandidateIndex*& index, uint32_t& row) const
+	 {
+	    if (!m_cand_index || vec != m_cand_vector) return false ;
+	    index = m_cand_index ; row = m_cand_row ;
+	    return true ;
+	 }
+      void setCandidateRow(const void* vec, const WcCandidateIndex* index, uint32_t row)
+	 { m_cand_vector = vec ; m_cand_index = index ; m_cand_row = row ; }
+      void clearCandidateRow() { m_cand_index = nullptr ; m_cand_vector = nullptr ; }
 
    protected:
       const WcWordCorpus* m_corpus ;
       const WcParameters& m_params ;
       Fr::ListPtr	  m_left_constraint ;
       Fr::ListPtr	  m_right_constraint ;
+      const void*	  m_normed_vector { nullptr } ;
+      double		  m_left_norm { 0.0 } ;
+      double		  m_right_norm { 0.0 } ;
+      const void*	  m_cand_vector { nullptr } ;
+      const WcCandidateIndex* m_cand_index { nullptr } ;
+      uint32_t		  m_cand_row { 0 } ;
    } ;
 
 //----------------------------------------------------------------------
@@ -66,7 +97,7 @@ class WcTermVectorSparse : public Fr::SparseVector<IdxT,float>
       static WcTermVectorSparse* create(size_t cap = 0) { return new WcTermVectorSparse(cap) ; }
       static WcTermVectorSparse* create(const WcWordCorpus* c, const WcParameters& p, size_t cap = 0)
 	 { return new WcTermVectorSparse(c,p,cap) ; }
-      static WcTermVectorSparse* create(const WcIDCountHashTable* counts, const WcWordCorpus* c,
+      static WcTermVectorSparse* create(WcIDCountHashTable* counts, const WcWordCorpus* c,
 	 const WcParameters& p)
 	 { return new WcTermVectorSparse(counts,c,p) ; }
 
@@ -75,6 +106,9 @@ class WcTermVectorSparse : public Fr::SparseVector<IdxT,float>
    public:
       // manipulators
       void weightTerms(WcDecayType decay, double null_weight) ;
+      void cacheSplitNorms() ;
+      // replace the contents with 'count' already-weighted elements sorted by index
+      void setElements(const IdxT* indices, const float* values, size_t count) ;
 
       const WcWordCorpus* corpus() const { return info()->corpus() ; }
       const WcParameters& params() const { return info()->params() ; }
@@ -92,7 +126,7 @@ class WcTermVectorSparse : public Fr::SparseVector<IdxT,float>
       WcTermVectorSparse(size_t capacity = 0) : super(capacity) {}
       WcTermVectorSparse(const WcWordCorpus* c, const WcParameters& p, size_t cap = 0) : super(cap)
 	 { this->setUserData(new WcTermVectorInfo(c,p)) ; }
-      WcTermVectorSparse(const WcIDCountHashTable* counts, const WcWordCorpus*, const WcParameters&) ;
+      WcTermVectorSparse(WcIDCountHashTable* counts, const WcWordCorpus*, const WcParameters&) ;
       ~WcTermVectorSparse()
 	 { delete reinterpret_cast<WcTermVectorInfo*>(this->userData()) ; this->setUserData(nullptr) ; }
 
@@ -118,7 +152,7 @@ class WcTermVectorDense : public Fr::DenseVector<uint32_t,float>
       static WcTermVectorDense* create(size_t cap = 0) { return new WcTermVectorDense(cap) ; }
       static WcTermVectorDense* create(const WcWordCorpus* c, const WcParameters& p, size_t cap = 0)
 	 { return new WcTermVectorDense(c,p,cap) ; }
-      static WcTermVectorDense* create(const WcIDCountHashTable* counts, const WcWordCorpus* c,
+      static WcTermVectorDense* create(WcIDCountHashTable* counts, const WcWordCorpus* c,
 	 const WcParameters& p)
 	 { return new WcTermVectorDense(counts,c,p) ; }
 
@@ -126,6 +160,7 @@ class WcTermVectorDense : public Fr::DenseVector<uint32_t,float>
 
       // manipulators
       void weightTerms(WcDecayType decay, double null_weight) ;
+      void setElements(const float* values, size_t count) ;
       void incr(const Vector<uint32_t,float>* other, float weight)
 	 {
 	    ((Vector<uint32_t,float>*)this)->incr(other,weight) ;
@@ -146,7 +181,7 @@ class WcTermVectorDense : public Fr::DenseVector<uint32_t,float>
       WcTermVectorDense(size_t cap = 0) : super(cap) { }
       WcTermVectorDense(const WcWordCorpus* c, const WcParameters& p, size_t cap = 0) : super(cap)
 	 { this->setUserData(new WcTermVectorInfo(c,p)) ; }
-      WcTermVectorDense(const WcIDCountHashTable* counts, const WcWordCorpus*, const WcParameters&) ;
+      WcTermVectorDense(WcIDCountHashTable* counts, const WcWordCorpus*, const WcParameters&) ;
       ~WcTermVectorDense()
 	 { delete reinterpret_cast<WcTermVectorInfo*>(this->userData()) ; this->setUserData(nullptr) ; }
 
@@ -172,7 +207,7 @@ class WcTermVector : public WcTermVectorSparse<WcWordCorpus::ID>
       typedef Fr::ContextVectorCollection<WcWordCorpus::ID,uint32_t,float,false> context_coll ;
    public:
       static WcTermVector* create(size_t cap = 0) { return static_cast<WcTermVector*>(super::create(cap)) ; }
-      static WcTermVector* create(const WcIDCountHashTable* counts, const WcWordCorpus* c,
+      static WcTermVector* create(WcIDCountHashTable* counts, const WcWordCorpus* c,
 	 const WcParameters& p)
 	 {
 	    if (p.contextCollection())
@@ -220,6 +255,31 @@ class VectorMeasureSplitCosine : public Fr::SimilarityMeasure<IdxT, ValT>
 
 //----------------------------------------------------------------------------
 
+// cosine or Euclidean comparison of dense (random-projection) term vectors using the SIMD
+//   kernels.
+//   A sparse vector (such as the placeholder for an unseen seed word) counts as all zeros.
+
+template <typename IdxT, typename ValT>
+class VectorMeasureDense : public Fr::SimilarityMeasure<IdxT, ValT>
+   {
+   public:
+      typedef Fr::SimilarityMeasure<IdxT, ValT> super ;
+   public:
+      VectorMeasureDense(bool euclidean = false) : m_euclidean(euclidean) {}
+      virtual ~VectorMeasureDense() {}
+
+      virtual double similarity(const Fr::Vector<IdxT,ValT>* v1, const Fr::Vector<IdxT,ValT>* v2) const ;
+      virtual double distance(const Fr::Vector<IdxT,ValT>* v1, const Fr::Vector<IdxT,ValT>* v2) const ;
+
+   protected:
+      virtual const char* myCanonicalName() const { return m_euclidean ? "DenseEuclidean" : "DenseCosine" ; }
+
+   protected:
+      bool m_euclidean ;
+   } ;
+
+//----------------------------------------------------------------------------
+
 #endif /* !__WCTRMVEC_H_INCLUDED */
 
 // end of file wctrmvec.h //
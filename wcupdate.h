@@ -0,0 +1,176 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*  WordClust -- Word Clustering					*/
+/*  Version 2.00							*/
+/*	 by Ralf Brown							*/
+/*									*/
+/*  File: wcupdate.h	      incremental updates of context counts	*/
+/*  LastEdit: 17oct2026							*/
+/*									*/
+/*  (c) Copyright 2018 Carnegie Mellon University			*/
+/*	This program may be redistributed and/or modified under the	*/
+/*	terms of the GNU General Public License, version 3, or an	*/
+/*	alternative license agreement as detailed in the accompanying	*/
+/*	file LICENSE.  You should also have received a copy of the	*/
+/*	GPL (file COPYING) along with this program.  If not, see	*/
+/*	http://www.gnu.org/licenses/					*/
+/*									*/
+/*	This program is distributed in the hope that it will be		*/
+/*	useful, but WITHOUT ANY WARRANTY; without even the implied	*/
+/*	warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR		*/
+/*	PURPOSE.  See the GNU General Public License for more details.	*/
+/*									*/
+/************************************************************************/
+
+
+#ifndef __WCUPDATE_H_INCLUDED
+#define __WCUPDATE_H_INCLUDED
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "wordclus.h"
+
+/************************************************************************/
+/*	Manifest Constants						*/
+/************************************************************************/
+
+#define WcCOUNTFILE_SIGNATURE "WcCtxCnt"
+#define WcCOUNTFILE_VERSION 1
+
+/************************************************************************/
+/*	Types								*/
+/************************************************************************/
+
+// The raw (unweighted) context counts of every term which received a term vector and of every
+//   other word which could become desired once more text is added (i.e. which is not a stopword),
+//   together with the vocabulary and word frequencies of all of the text counted so far.  The weights depend on
+//   corpus-wide word frequencies, so the weighted vectors can't simply be added to; the raw counts
+//   can, which lets new text be folded in by counting only the contexts in that text.  Context
+//   words are stored by their index in the vocabulary here plus their offset from the term, so
+//   the counts don't depend on the word IDs of any particular corpus.
+
+class WcContextCounts
+   {
+   public:
+      class Entry
+	 {
+	 public:
+	    uint32_t word ;
+	    int32_t  offset ;
+	    uint32_t count ;
+	 } ;
+      class Term
+	 {
+	 public:
+	    uint64_t freq { 0 } ;
+	    std::vector<Entry> entries ;	// sorted by word, then offset
+	 } ;
+      typedef std::unordered_map<std::string,Term> TermMap ;
+
+   public:
+      WcContextCounts() {}
+      WcContextCounts(const WcContextCounts&) = delete ;
+      ~WcContextCounts() = default ;
+      WcContextCounts& operator= (const WcContextCounts&) = delete ;
+
+      // take the vocabulary and word frequencies from 'corpus'; must be called before addTerm(),
+      //   since the counts added from that corpus are stored by its word IDs
+      void setVocabulary(const WcWordCorpus* corpus, const WcParameters& params) ;
+      // record (or add to) the contexts of a term; may be called from multiple threads
+      void addTerm(const WcWordCorpus* corpus, const char* key, size_t freq, const WcIDCountHashTable& counts) ;
+      // fold in the word frequencies and term counts from another set of counts
+      void merge(const WcContextCounts& delta) ;
+
+      // build a weighted term vector from the counts of each term which is desired given the
+      //   combined word frequencies in 'corpus', storing them in 'key_words'
+      size_t makeVectors(const WcWordCorpus* corpus, const WcParameters& params,
+			 Fr::SymHashTable* key_words) const ;
+      // the selection function for WcCountContexts: does the term need its contexts counted
+      //   in the new text?  'udata' is the WcContextCounts for the text seen previously
+      static bool updatedTerm(const WcWordCorpus* corpus, const WcWordCorpus::ID* key, unsigned keylen,
+			      void* udata) ;
+      // the selection function for WcCountContexts when the counts are first collected: a word
+      //   which did not get a term vector, but might once more text is added
+      static bool possibleTerm(const WcWordCorpus* corpus, const WcWordCorpus::ID* key, unsigned keylen,
+			       void* udata) ;
+
+      bool save(const char* filename) const ;
+      bool load(const char* filename) ;
+
+      // accessors
+      const Term* find(const char* key) const ;
+      const TermMap& terms() const { return m_terms ; }
+      size_t numTerms() const { return m_terms.size() ; }
+      size_t numWords() const { return m_words.size() ; }
+      const char* word(size_t N) const { return m_words[N].c_str() ; }
+      uint64_t wordFreq(size_t N) const { return m_word_freqs[N] ; }
+      uint64_t totalTokens() const { return m_tokens ; }
+      uint32_t newlineWord() const { return m_newline ; }
+      unsigned neighborhoodLeft() const { return m_left ; }
+      unsigned neighborhoodRight() const { return m_right ; }
+
+   protected:
+      uint32_t addWord(const std::string& word, uint64_t freq) ;
+
+   protected:
+      TermMap		    m_terms ;
+      std::vector<std::string> m_words ;
+      std::vector<uint64_t> m_word_freqs ;
+      std::unordered_map<std::string,uint32_t> m_word_index ;
+      std::mutex	    m_lock ;
+      uint64_t		    m_tokens { 0 } ;
+      uint32_t		    m_newline { 0 } ;
+      unsigned		    m_left { 0 } ;
+      unsigned		    m_right { 0 } ;
+   } ;
+
+//----------------------------------------------------------------------
+// the on-disk form: a header followed by 8-byte-aligned sections
+//	words[num_words]	string offset and frequency of each vocabulary entry
+//	terms[num_terms]	string offset of the key, frequency, and range of entries
+//	entries[num_entries]	WcContextCounts::Entry
+//	strings[string_bytes]	NUL-terminated words and keys
+
+class WcCountFileHeader
+   {
+   public:
+      char     signature[8] ;
+      uint32_t version ;
+      uint32_t byte_order ;		// WcVECFILE_BYTE_ORDER as written by the creating host
+      uint64_t num_words ;
+      uint64_t num_terms ;
+      uint64_t num_entries ;
+      uint64_t string_bytes ;
+      uint64_t total_tokens ;
+      uint64_t words_offset ;
+      uint64_t terms_offset ;
+      uint64_t entries_offset ;
+      uint64_t strings_offset ;
+      uint32_t newline_word ;
+      uint32_t neighborhood_left ;
+      uint32_t neighborhood_right ;
+      uint32_t reserved ;
+   } ;
+
+class WcCountFileWord
+   {
+   public:
+      uint64_t string ;
+      uint64_t freq ;
+   } ;
+
+class WcCountFileTerm
+   {
+   public:
+      uint64_t key ;
+      uint64_t freq ;
+      uint64_t first_entry ;
+      uint64_t num_entries ;
+   } ;
+
+#endif /* !__WCUPDATE_H_INCLUDED */
+
+// end of file wcupdate.h //
@@ -0,0 +1,110 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*  WordClust -- Word Clustering					*/
+/*  Version 2.00							*/
+/*	 by Ralf Brown							*/
+/*									*/
+/*  File: wcvecfile.h	      term-vector checkpoint files		*/
+/*  LastEdit: 17oct2026							*/
+/*									*/
+/*  (c) Copyright 2018 Carnegie Mellon University			*/
+/*	This program may be redistributed and/or modified under the	*/
+/*	terms of the GNU General Public License, version 3, or an	*/
+/*	alternative license agreement as detailed in the accompanying	*/
+/*	file LICENSE.  You should also have received a copy of the	*/
+/*	GPL (file COPYING) along with this program.  If not, see	*/
+/*	http://www.gnu.org/licenses/					*/
+/*									*/
+/*	This program is distributed in the hope that it will be		*/
+/*	useful, but WITHOUT ANY WARRANTY; without even the implied	*/
+/*	warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR		*/
+/*	PURPOSE.  See the GNU General Public License for more details.	*/
+/*									*/
+/************************************************************************/
+
+
+#ifndef __WCVECFILE_H_INCLUDED
+#define __WCVECFILE_H_INCLUDED
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "wordclus.h"
+
+/************************************************************************/
+/*	Manifest Constants						*/
+/************************************************************************/
+
+#define WcVECFILE_SIGNATURE "WcTrmVec"
+#define WcVECFILE_VERSION 1
+
+// written in native byte order; a file from a host of the other endianness reads differently
+#define WcVECFILE_BYTE_ORDER 0x01020304
+
+/************************************************************************/
+/*	Types								*/
+/************************************************************************/
+
+// A checkpoint holds the weighted term vectors produced by the context analysis, so that
+//   clustering can be rerun with different settings without the corpus.  The file is a header
+//   followed by 8-byte-aligned sections which are used in place after memory-mapping:
+//	records[num_vectors]	one per vector, in hash-table order
+//	indices[num_elements]	uint32 context IDs (sparse vectors only)
+//	values[num_elements]	float weights; 'dimensions' per vector for dense vectors
+//	words[num_words]	string offsets of the left/right constraint words
+//	strings[string_bytes]	NUL-terminated keys and words; constraint words are shared
+
+class WcVecFileHeader
+   {
+   public:
+      char     signature[8] ;
+      uint32_t version ;
+      uint32_t byte_order ;		// WcVECFILE_BYTE_ORDER as written by the creating host
+      uint64_t num_vectors ;
+      uint64_t num_elements ;
+      uint64_t num_words ;
+      uint64_t string_bytes ;
+      uint64_t records_offset ;
+      uint64_t indices_offset ;
+      uint64_t values_offset ;
+      uint64_t words_offset ;
+      uint64_t strings_offset ;
+      uint32_t neighborhood_left ;
+      uint32_t neighborhood_right ;
+      uint32_t dimensions ;		// 0 for sparse vectors
+      uint32_t reserved ;
+   } ;
+
+class WcVecFileRecord
+   {
+   public:
+      uint64_t table_key ;		// string offset of the vector's key in the hash table
+      uint64_t vector_key ;		// string offset of the vector's own key
+      uint64_t first_element ;
+      uint64_t first_word ;
+      double   weight ;			// the term's frequency
+      uint32_t num_elements ;
+      uint16_t num_left ;		// constraint words; the right ones follow the left
+      uint16_t num_right ;
+   } ;
+
+/************************************************************************/
+/************************************************************************/
+
+// write the term vectors in 'key_words' to 'filename'
+bool WcSaveTermVectors(const char* filename, const Fr::SymHashTable* key_words,
+		       const WcParameters& params) ;
+
+// read a checkpoint into a new hash table of term vectors; 'corpus' receives an empty corpus
+//   with the context sizes the vectors were built with, which the vectors and the similarity
+//   measures need, and 'params' is updated to match.  The vectors refer to 'params', which
+//   must outlive them.
+Fr::SymHashTable* WcLoadTermVectors(const char* filename, WcParameters& params,
+				    WcWordCorpus*& corpus) ;
+
+// concatenate the checkpoints in 'parts' into a single checkpoint, one section at a time
+bool WcMergeTermVectors(const char* filename, const std::vector<std::string>& parts) ;
+
+#endif /* !__WCVECFILE_H_INCLUDED */
+
+// end of file wcvecfile.h //
@@ -0,0 +1,87 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*  WordClust -- Word Clustering					*/
+/*  Version 2.00							*/
+/*	 by Ralf Brown							*/
+/*									*/
+/*  File: wcwarm.h	      warm-start reclustering			*/
+/*  LastEdit: 17oct2026							*/
+/*									*/
+/*  (c) Copyright 2018 Carnegie Mellon University			*/
+/*	This program may be redistributed and/or modified under the	*/
+/*	terms of the GNU General Public License, version 3, or an	*/
+/*	alternative license agreement as detailed in the accompanying	*/
+/*	file LICENSE.  You should also have received a copy of the	*/
+/*	GPL (file COPYING) along with this program.  If not, see	*/
+/*	http://www.gnu.org/licenses/					*/
+/*									*/
+/*	This program is distributed in the hope that it will be		*/
+/*	useful, but WITHOUT ANY WARRANTY; without even the implied	*/
+/*	warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR		*/
+/*	PURPOSE.  See the GNU General Public License for more details.	*/
+/*									*/
+/************************************************************************/
+
+
+#ifndef __WCWARM_H_INCLUDED
+#define __WCWARM_H_INCLUDED
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "wordclus.h"
+
+/************************************************************************/
+/*	Types								*/
+/************************************************************************/
+
+// the cluster to which a term was assigned by an earlier run, and the term's frequency at the time
+class WcAssignment
+   {
+   public:
+      uint32_t cluster ;
+      double   weight ;
+   } ;
+
+//----------------------------------------------------------------------
+// Starts clustering from the clusters of an earlier run.  Terms whose frequency has not changed
+//   keep their cluster; new and changed terms are assigned to the cluster with the nearest
+//   centroid (if similar enough); and any cluster whose centroid moves too far as a result is
+//   dissolved.  The surviving assignments are returned as a table of fixed assignments, which
+//   cluster_vectors() merges into its result after clustering only the terms which are left over.
+
+class WcWarmStart
+   {
+   public:
+      WcWarmStart() {}
+      WcWarmStart(const WcWarmStart&) = delete ;
+      ~WcWarmStart() = default ;
+      WcWarmStart& operator= (const WcWarmStart&) = delete ;
+
+      // read the assignments written by WcSaveAssignments()
+      bool load(const char* filename) ;
+      // map each term of 'key_words' which keeps or joins a previous cluster to that cluster's
+      //   label; terms in 'seeds' are left to the seeds.  Uses the configured clustering measure
+      //   unless 'measure' is given.
+      Fr::SymHashTable* assign(const Fr::SymHashTable* key_words, const WcParameters& params,
+			       const WcWordCorpus* corpus, const Fr::SymHashTable* seeds,
+			       Fr::VectorMeasure<WcWordCorpus::ID,float>* measure) ;
+
+      // accessors
+      size_t numClusters() const { return m_labels.size() ; }
+      size_t numAssignments() const { return m_previous.size() ; }
+
+   protected:
+      std::vector<Fr::Symbol*> m_labels ;
+      std::unordered_map<std::string,WcAssignment> m_previous ;
+   } ;
+
+/************************************************************************/
+/************************************************************************/
+
+// write the cluster to which each clustered term was assigned, for a later warm start
+bool WcSaveAssignments(const char* filename, const Fr::ClusterInfo* clusters) ;
+
+#endif /* !__WCWARM_H_INCLUDED */
+
+// end of file wcwarm.h //
@@ -0,0 +1,107 @@
+/****************************** -*- C++ -*- *****************************/
+/*									*/
+/*  WordClust -- Word Clustering					*/
+/*  Version 2.00							*/
+/*	 by Ralf Brown							*/
+/*									*/
+/*  File: wcweight.h	      precomputed term-weighting tables		*/
+/*  LastEdit: 17oct2026							*/
+/*									*/
+/*  (c) Copyright 2018 Carnegie Mellon University			*/
+/*	This program may be redistributed and/or modified under the	*/
+/*	terms of the GNU General Public License, version 3, or an	*/
+/*	alternative license agreement as detailed in the accompanying	*/
+/*	file LICENSE.  You should also have received a copy of the	*/
+/*	GPL (file COPYING) along with this program.  If not, see	*/
+/*	http://www.gnu.org/licenses/					*/
+/*									*/
+/*	This program is distributed in the hope that it will be		*/
+/*	useful, but WITHOUT ANY WARRANTY; without even the implied	*/
+/*	warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR		*/
+/*	PURPOSE.  See the GNU General Public License for more details.	*/
+/*									*/
+/************************************************************************/
+
+#ifndef __WCWEIGHT_H_INCLUDED
+#define __WCWEIGHT_H_INCLUDED
+
+#include <cmath>
+#include <vector>
+#include "wordclus.h"
+
+/************************************************************************/
+/*	Manifest Constants						*/
+/************************************************************************/
+
+// context counts below this value get their frequency discount from a table instead of pow()
+#define WcWEIGHT_DISCOUNT_TABLE_SIZE 1024
+
+/************************************************************************/
+/*	Types								*/
+/************************************************************************/
+
+// the weight applied to a positional context depends only on the context word (its corpus
+//   frequency, and whether it is the sentence boundary) and its offset from the term, so we
+//   compute a weight for every word and every offset once per run; weighting a term vector then
+//   reduces to a pair of table lookups and a multiply per element
+
+class WcWeightTables
+   {
+   public:
+      // 'word_probs', if given, replaces the corpus's relative word frequencies (indexed by word
+      //   ID), e.g. when the vectors were counted from more text than 'corpus' holds
+      WcWeightTables(const WcWordCorpus* corpus, const WcParameters& params, WcDecayType decay,
+		     double null_weight, const std::vector<double>* word_probs = nullptr) ;
+      WcWeightTables(const WcWeightTables&) = delete ;
+      ~WcWeightTables() = default ;
+      WcWeightTables& operator= (const WcWeightTables&) = delete ;
+
+      // are these tables applicable to vectors built from 'corpus' with the given weighting?
+      bool matches(const WcWordCorpus* corpus, WcDecayType decay, double null_weight) const
+	 { return corpus == m_corpus && decay == m_decay && null_weight == m_null_weight ; }
+
+      // reweight the elements of a term vector in place
+      void apply(const WcWordCorpus::ID* indices, float* values, size_t n) const ;
+      // the weighted value of a single context count
+      double weigh(WcWordCorpus::ID id, double value) const
+	 {
+	    int pos = WcWordCorpus::offsetOfPosition(id,m_left_context,m_total_context) ;
+	    if (pos == 0)
+	       return value ;			// the term itself is never reweighted
+	    if (m_discount != 1.0)
+	       {
+	       uint32_t count = (uint32_t)value ;
+	       // round to float, as when the discounted count is stored back into the vector
+	       value = (float)((count == value && count < WcWEIGHT_DISCOUNT_TABLE_SIZE) ? m_discounted[count]
+			       : pow(value,m_discount)) ;
+	       }
+	    auto word = m_corpus->wordForPositionalID(id) ;
+	    double freqwt = (word < m_word_weights.size()) ? m_word_weights[word]
+	       : wordWeight(m_corpus,m_params,word,m_null_weight) ;
+	    return value * (m_position_weights[pos + (int)m_total_context] * freqwt) ;
+	 }
+
+      // the underlying weighting functions, for use when no tables are available
+      static double wordWeight(const WcWordCorpus* corpus, const WcParameters& params,
+			       WcWordCorpus::ID word, double null_weight) ;
+      static double frequencyWeight(const WcParameters& params, double wordprob) ;
+      static double positionWeight(const WcWordCorpus* corpus, WcDecayType decay, double alpha, int pos) ;
+      static double weigh(const WcWordCorpus* corpus, const WcParameters& params, WcDecayType decay,
+			  double null_weight, WcWordCorpus::ID id, double value) ;
+
+   protected:
+      std::vector<double> m_word_weights ;	// indexed by word ID
+      std::vector<double> m_position_weights ;	// indexed by offset + m_total_context
+      std::vector<double> m_discounted ;	// pow(count,termfreq_discount) for small counts
+      const WcWordCorpus* m_corpus ;
+      const WcParameters& m_params ;
+      double		  m_null_weight ;
+      double		  m_discount ;
+      WcDecayType	  m_decay ;
+      unsigned		  m_left_context ;
+      unsigned		  m_total_context ;
+   } ;
+
+#endif /* !__WCWEIGHT_H_INCLUDED */
+
+// end of file wcweight.h //
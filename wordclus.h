@@ -5,7 +5,7 @@
 /*	 by Ralf Brown							*/
 /*									*/
 /*  File: wordclus.h	      word clustering (declarations)		*/
-/*  LastEdit: 21sep2018							*/
+/*  LastEdit: 16oct2026							*/
 /*									*/
 /*  (c) Copyright 1999,2000,2001,2002,2003,2005,2006,2008,2009,2010,	*/
 /*		2015,2016,2017,2018 Carnegie Mellon University		*/
@@ -26,12 +26,14 @@
 #ifndef __WORDCLUS_H_INCLUDED
 #define __WORDCLUS_H_INCLUDED
 
+#include <unordered_map>
 #include "framepac/cluster.h"
 #include "framepac/file.h"
 #include "framepac/hashtable.h"
 #include "framepac/list.h"
 #include "framepac/threshold.h"
 #include "framepac/wordcorpus.h"
+#include "wcidhash.h"
 
 /************************************************************************/
 /*	Manifest Constants						*/
@@ -73,29 +75,6 @@ enum WcDecayType
 
 //--------------------------------------------------------------------------
 
-//--------------------------------------------------------------------------
-
-namespace Fr
-{
-template <>
-inline size_t HashTable<unsigned,size_t>::hashVal(const char* keyname, size_t* namelen) const
-{ *namelen = strlen(keyname) ; return (size_t)keyname ; } //FIXME
-
-
-template <>
-inline bool HashTable<unsigned,size_t>::isEqual(const char* keyname, size_t keylen, unsigned other)
-{
-   (void)keyname; (void)keylen; (void)other ;
-   return false ; //FIXME
-}
-
-typedef HashTable<unsigned,size_t> WcIDCountHashTable ;
-} // end namespace Fr
-
-using Fr::WcIDCountHashTable ;
-
-//--------------------------------------------------------------------------
-
 typedef bool WcGlobalFilterFunc(const Fr::Array* tvs, const WcParameters* params, void* user_data) ;
 typedef bool WcVectorFilterFunc(const WcTermVector *tv, const WcParameters *params,
                                 const Fr::SymHashTable *keys, void *user_data) ;
@@ -107,6 +86,8 @@ typedef void WcClusterFilterFunc(Fr::ClusterInfo* clust, const WcParameters *par
 typedef Fr::ClusterInfo *WcClusterPostprocFunc(Fr::ClusterInfo *clusters, void *user_data) ;
 
 typedef void WcWordFreqProcFunc(class WcParameters &params, size_t corpus_size) ;
+typedef bool WcTermSelectFunc(const WcWordCorpus* corpus, const WcWordCorpus::ID* key, unsigned keylen,
+			      void* udata) ;
 
 typedef double WcMIScoreFuncID(const WcWordCorpus*,
 			       WcWordCorpus::ID word1, WcWordCorpus::ID word2,
@@ -135,19 +116,46 @@ Fr::List *load_file_list(const char* listfile) ;
 bool generate_indices(WcWordCorpus *corpus, bool reverse) ;
 WcWordCorpus* new_corpus(const WcParameters* params, const char *filename = nullptr) ;
 WcWordCorpus* load_corpus(const Fr::List *filelist, const WcParameters *params = nullptr) ;
-WcWordCorpus* load_or_generate_corpus(const char *filename, const WcParameters* params) ;
+// if 'seeded' is given, the text is tokenized into that corpus, whose vocabulary may already
+//   have been populated, instead of a new one
+WcWordCorpus* load_or_generate_corpus(const char *filename, const WcParameters* params,
+				      WcWordCorpus* seeded = nullptr) ;
 
 // preprocessing
+// 'word_freqs', if given, overrides the corpus frequency of each word ID
+bool WcTagDesiredWords(const WcWordCorpus* corpus, const WcParameters* params,
+		       const uint64_t* word_freqs = nullptr) ;
 class WcWordIDPairTable *WcComputeMutualInfo(const WcWordCorpus* corpus,
 				               const WcParameters* params) ;
+// build a term vector for each desired word/phrase, stored in 'key_words'; only words/phrases
+//   whose first word's ID lies in the range first_id..last_id-1 are processed
+void WcAnalyzeContexts(const WcWordCorpus* corpus, const WcParameters* params,
+		       Fr::SymHashTable* key_words, WcWordCorpus::ID first_id = 0,
+		       WcWordCorpus::ID last_id = WcWordCorpus::ErrorID) ;
+
+// collect the raw context counts of each word/phrase accepted by 'select' into
+//   params->contextCounts(), without building term vectors
+void WcCountContexts(const WcWordCorpus* corpus, const WcParameters* params, WcTermSelectFunc* select,
+		     void* select_data) ;
 
-void WcRemoveAutoClustersFromSeeds(Fr::ObjHashTable* seeds) ;
+void WcRemoveAutoClustersFromSeeds(Fr::SymHashTable* seeds) ;
 
-// the actual clustering
+// the actual clustering; terms listed in 'fixed' (term -> cluster label) are not clustered, but
+//   are added to the cluster with their label afterwards
 Fr::ClusterInfo* cluster_vectors(Fr::SymHashTable* ht, const WcParameters* params,
 			  const WcWordCorpus* corpus, Fr::SymHashTable* seeds = nullptr,
 			  Fr::VectorMeasure<WcWordCorpus::ID,float>* measure = nullptr,
-			  bool verbose = false) ;
+			  bool verbose = false, const Fr::SymHashTable* fixed = nullptr) ;
+
+// create the similarity measure selected by params->clusteringMeasure(), the same one the
+//   clustering uses; the caller must free() it
+Fr::VectorMeasure<WcWordCorpus::ID,float>* WcClusteringMeasure(const WcParameters* params,
+							       const WcWordCorpus* corpus) ;
+
+// the clustering pass of WcProcessCorpus, including any pre- and post-filtering
+Fr::ClusterInfo* WcClusterTermVectors(Fr::SymHashTable* key_words, const WcParameters& params,
+				      const WcWordCorpus* corpus,
+				      Fr::VectorMeasure<WcWordCorpus::ID,float>* measure, int& passnum) ;
 
 // top-level processing functions
 bool WcProcessCorpus(WcWordCorpus* corpus,  // deletes corpus to save memory!
@@ -156,8 +164,43 @@ bool WcProcessCorpus(WcWordCorpus* corpus,  // deletes corpus to save memory!
                      const WcParameters* global_params,
 		     const char* outfilename, const char *tokfilename,
 		     const char* tagfilename) ;
+// run only the passes which build the term vectors, and save them to params->saveVectorsFile()
+bool WcSaveCorpusVectors(WcWordCorpus* corpus,  // deletes corpus to save memory!
+			 const WcParameters* global_params) ;
+// as WcProcessCorpus, but cluster the term vectors saved in 'vector_file' by an earlier run
+bool WcProcessVectors(const char* vector_file, Fr::VectorMeasure<WcWordCorpus::ID,float>* measure,
+		      Fr::CFile& outfp, Fr::CFile& tokfp, Fr::CFile& tagfp,
+		      const WcParameters* global_params,
+		      const char* outfilename, const char *tokfilename,
+		      const char* tagfilename) ;
+
+// fold the text in 'filename', which must not have been counted before, into the context counts
+//   saved in 'counts_file' by an earlier run, then build and cluster the term vectors as
+//   WcProcessCorpus does; only the new text is read, indexed, and scanned for contexts.  The
+//   updated counts are saved to params->saveCountsFile() if set.
+bool WcUpdateCorpus(const char* counts_file, const char* filename,
+		    Fr::VectorMeasure<WcWordCorpus::ID,float>* measure,
+		    Fr::CFile& outfp, Fr::CFile& tokfp, Fr::CFile& tagfp,
+		    const WcParameters* global_params,
+		    const char* outfilename, const char *tokfilename,
+		    const char* tagfilename) ;
 
 // output of results
+// the labels which one clustering gave its term vectors, kept apart from the vectors so that
+//   another clustering of the same vectors can proceed while the first one's results are written
+typedef std::unordered_map<const Fr::Object*,const Fr::Symbol*> WcLabelTable ;
+// write the cluster file, token file and tagged corpus as configured by 'params'; if 'labels' is
+//   given, it rather than the vectors' own labels says which vectors were labeled
+void WcWriteClusters(const Fr::ClusterInfo* clusters, const WcParameters& params,
+		     Fr::CFile& outfp, Fr::CFile& tokfp, Fr::CFile& tagfp,
+		     const char* outfilename, const char* tokfilename, const char* tagfilename,
+		     const WcLabelTable* labels = nullptr) ;
+// write all of the output files whose CFile is open in a single parallel pass over the clusters
+void WcOutputResults(const Fr::ClusterInfo* clusters, Fr::CFile& outfp, Fr::CFile& tokfp,
+		     Fr::CFile& tagfp, const char* seed_file, bool sort_output = true,
+		     const char* outfilename = nullptr, const char* tokfilename = nullptr,
+		     const char* tagfilename = nullptr, bool skip_auto_clusters = false,
+		     bool suppress_auto_brackets = false, const WcLabelTable* labels = nullptr) ;
 void WcOutputClusters(const Fr::ClusterInfo* clusters, Fr::CFile& outfp,
 		      const char* seed_file, bool sort_output = true,
 		      const char* output_filename = nullptr,
@@ -171,6 +214,13 @@ void WcOutputTaggedCorpus(const Fr::ClusterInfo* cluster_list, Fr::CFile& tagfp,
 			  bool sort_output = true,
 			  const char* output_filename = nullptr,
 			  bool skip_auto_clusters = false) ;
+// as WcOutputTaggedCorpus, but renders the entries in chunks of 'chunk_entries' which are
+//   sorted and spilled to temporary files, then merged; memory use is bounded by the chunk size
+void WcOutputTaggedCorpusStreaming(const Fr::ClusterInfo* cluster_list, Fr::CFile& tagfp,
+				   size_t chunk_entries, bool sort_output = true,
+				   const char* output_filename = nullptr,
+				   bool skip_auto_clusters = false,
+				   const WcLabelTable* labels = nullptr) ;
 
 // cleanup
 void WcClearWordDelimiters() ;